@@ -78,7 +78,7 @@ gisthandler(PG_FUNCTION_ARGS)
 		.amclusterable = true,
 		.ampredlocks = true,
 		.amcanparallel = false,
-		.amcanbuildparallel = false,
+		.amcanbuildparallel = true,
 		.amcaninclude = true,
 		.amusemaintenanceworkmem = false,
 		.amsummarizing = false,
@@ -16,6 +16,7 @@
 
 #include "access/heapam.h"
 #include "access/relscan.h"
+#include "storage/bufmgr.h"
 #include "storage/predicate.h"
 
 
@@ -66,6 +67,20 @@ heapam_index_fetch_end(IndexFetchTableData *scan)
 	pfree(hscan);
 }
 
+bool
+heapam_index_fetch_prefetch(IndexFetchTableData *scan, ItemPointer tid)
+{
+#ifdef USE_PREFETCH
+	IndexFetchHeapData *hscan = (IndexFetchHeapData *) scan;
+	BlockNumber blkno = ItemPointerGetBlockNumber(tid);
+
+	/* no point in prefetching the page we already hold a pin on */
+	if (blkno != hscan->xs_blk)
+		return PrefetchBuffer(scan->rel, MAIN_FORKNUM, blkno).initiated_io;
+#endif
+	return false;
+}
+
 /*
  *	heap_hot_search_buffer	- search HOT chain for tuple satisfying snapshot
  *
@@ -420,6 +420,15 @@ btrescan(IndexScanDesc scan, ScanKey scankey, int nscankeys,
 				   IsMVCCLikeSnapshot(scan->xs_snapshot) &&
 				   scan->heapRelation != NULL);
 
+	/*
+	 * Reset the state used to prefetch the heap tuples of upcoming items on
+	 * the current leaf page.  Whether to prefetch at all, and how far ahead,
+	 * is decided by the caller through scan->xs_prefetch_maximum.
+	 */
+	so->prefetchDistance = 0;
+	so->prefetchDir = NoMovementScanDirection;
+	so->prefetchItem = 0;
+
 	so->markItemIndex = -1;
 	so->needPrimScan = false;
 	so->scanBehind = false;
@@ -518,6 +527,9 @@ btrestrpos(IndexScanDesc scan)
 {
 	BTScanOpaque so = (BTScanOpaque) scan->opaque;
 
+	/* Either way, the heap prefetch position no longer applies */
+	so->prefetchDir = NoMovementScanDirection;
+
 	if (so->markItemIndex >= 0)
 	{
 		/*
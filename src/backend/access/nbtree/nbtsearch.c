@@ -17,6 +17,7 @@
 
 #include "access/nbtree.h"
 #include "access/relscan.h"
+#include "access/tableam.h"
 #include "access/xact.h"
 #include "executor/instrument_node.h"
 #include "miscadmin.h"
@@ -33,7 +34,10 @@ static Buffer _bt_moveright(Relation rel, Relation heaprel, BTScanInsert key,
 static OffsetNumber _bt_binsrch(Relation rel, BTScanInsert key, Buffer buf);
 static int	_bt_binsrch_posting(BTScanInsert key, Page page,
 								OffsetNumber offnum);
-static inline void _bt_returnitem(IndexScanDesc scan, BTScanOpaque so);
+static inline void _bt_returnitem(IndexScanDesc scan, BTScanOpaque so,
+								  ScanDirection dir);
+static void _bt_prefetch_heap(IndexScanDesc scan, BTScanOpaque so,
+							  ScanDirection dir);
 static bool _bt_steppage(IndexScanDesc scan, ScanDirection dir);
 static bool _bt_readfirstpage(IndexScanDesc scan, OffsetNumber offnum,
 							  ScanDirection dir);
@@ -941,7 +945,7 @@ _bt_first(IndexScanDesc scan, ScanDirection dir)
 		if (!_bt_readnextpage(scan, blkno, lastcurrblkno, dir, true))
 			return false;
 
-		_bt_returnitem(scan, so);
+		_bt_returnitem(scan, so, dir);
 		return true;
 	}
 
@@ -1564,7 +1568,7 @@ _bt_first(IndexScanDesc scan, ScanDirection dir)
 	if (!_bt_readfirstpage(scan, offnum, dir))
 		return false;
 
-	_bt_returnitem(scan, so);
+	_bt_returnitem(scan, so, dir);
 	return true;
 }
 
@@ -1610,7 +1614,7 @@ _bt_next(IndexScanDesc scan, ScanDirection dir)
 		}
 	}
 
-	_bt_returnitem(scan, so);
+	_bt_returnitem(scan, so, dir);
 	return true;
 }
 
@@ -1619,7 +1623,7 @@ _bt_next(IndexScanDesc scan, ScanDirection dir)
  * index scan by setting the relevant fields in caller's index scan descriptor
  */
 static inline void
-_bt_returnitem(IndexScanDesc scan, BTScanOpaque so)
+_bt_returnitem(IndexScanDesc scan, BTScanOpaque so, ScanDirection dir)
 {
 	BTScanPosItem *currItem = &so->currPos.items[so->currPos.itemIndex];
 
@@ -1632,6 +1636,90 @@ _bt_returnitem(IndexScanDesc scan, BTScanOpaque so)
 	scan->xs_heaptid = currItem->heapTid;
 	if (so->currTuples)
 		scan->xs_itup = (IndexTuple) (so->currTuples + currItem->tupleOffset);
+
+	/* Tell the table AM about heap tuples we'll need soon */
+	if (scan->xs_prefetch_maximum > 0 && scan->xs_heapfetch != NULL)
+		_bt_prefetch_heap(scan, so, dir);
+}
+
+/*
+ * Issue prefetch requests for heap tuples referenced by upcoming items
+ *
+ * Plain index scans fetch heap tuples one TID at a time, in index order, so
+ * each heap access that misses shared buffers stalls on a synchronous read.
+ * The TIDs for the rest of the current leaf page are already saved in
+ * so->currPos.items[], though, which lets us look ahead and hand the TIDs
+ * the scan is about to visit (in direction 'dir') to the table AM as
+ * prefetch hints.  Consecutive items that point to the same heap block only
+ * result in a single prefetch request.
+ *
+ * The look-ahead distance adapts in much the same way as a read stream's.
+ * It doubles, up to scan->xs_prefetch_maximum, after each item returned for
+ * which the table AM had to start I/O, so scans that stop after a handful of
+ * tuples (e.g. due to a LIMIT) don't issue I/O for blocks they will never
+ * read.  It shrinks by one for every block found to be cached already, and
+ * once it reaches zero we stop prefetching until the next leaf page is read.
+ * A fully cached scan therefore pays for about one prefetch lookup per leaf
+ * page.
+ */
+static void
+_bt_prefetch_heap(IndexScanDesc scan, BTScanOpaque so, ScanDirection dir)
+{
+	BTScanPos	pos = &so->currPos;
+	bool		started_io = false;
+
+	/* Start over from the current item on a new page or change of direction */
+	if (so->prefetchDir != dir)
+	{
+		so->prefetchDir = dir;
+		so->prefetchItem = pos->itemIndex;
+		so->prefetchDistance = Max(so->prefetchDistance, 1);
+	}
+
+	if (ScanDirectionIsForward(dir))
+	{
+		so->prefetchItem = Max(so->prefetchItem, pos->itemIndex);
+		while (so->prefetchDistance > 0 &&
+			   so->prefetchItem < Min(pos->itemIndex + so->prefetchDistance,
+									  pos->lastItem))
+		{
+			int			i = ++so->prefetchItem;
+
+			if (ItemPointerGetBlockNumber(&pos->items[i].heapTid) ==
+				ItemPointerGetBlockNumber(&pos->items[i - 1].heapTid))
+				continue;
+
+			if (table_index_fetch_prefetch(scan->xs_heapfetch,
+										   &pos->items[i].heapTid))
+				started_io = true;
+			else
+				so->prefetchDistance--;
+		}
+	}
+	else
+	{
+		so->prefetchItem = Min(so->prefetchItem, pos->itemIndex);
+		while (so->prefetchDistance > 0 &&
+			   so->prefetchItem > Max(pos->itemIndex - so->prefetchDistance,
+									  pos->firstItem))
+		{
+			int			i = --so->prefetchItem;
+
+			if (ItemPointerGetBlockNumber(&pos->items[i].heapTid) ==
+				ItemPointerGetBlockNumber(&pos->items[i + 1].heapTid))
+				continue;
+
+			if (table_index_fetch_prefetch(scan->xs_heapfetch,
+										   &pos->items[i].heapTid))
+				started_io = true;
+			else
+				so->prefetchDistance--;
+		}
+	}
+
+	if (started_io)
+		so->prefetchDistance = Min(Max(so->prefetchDistance, 1) * 2,
+								   scan->xs_prefetch_maximum);
 }
 
 /*
@@ -2232,6 +2320,6 @@ _bt_endpoint(IndexScanDesc scan, ScanDirection dir)
 	if (!_bt_readfirstpage(scan, start, dir))
 		return false;
 
-	_bt_returnitem(scan, so);
+	_bt_returnitem(scan, so, dir);
 	return true;
 }
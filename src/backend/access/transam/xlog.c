@@ -74,6 +74,7 @@
 #include "pg_trace.h"
 #include "pgstat.h"
 #include "port/atomics.h"
+#include "port/pg_iovec.h"
 #include "postmaster/bgwriter.h"
 #include "postmaster/datachecksum_state.h"
 #include "postmaster/startup.h"
@@ -150,11 +151,12 @@ bool		XLOG_DEBUG = false;
 int			wal_segment_size = DEFAULT_XLOG_SEG_SIZE;
 
 /*
- * Number of WAL insertion locks to use. A higher value allows more insertions
- * to happen concurrently, but adds some CPU overhead to flushing the WAL,
- * which needs to iterate all the locks.
+ * Number of WAL insertion locks to use (wal_insert_locks). A higher value
+ * allows more insertions to happen concurrently, but adds some CPU overhead
+ * to flushing the WAL, which needs to iterate all the locks.  -1 means
+ * choose a value based on max_connections, see XLOGChooseNumInsertLocks().
  */
-#define NUM_XLOGINSERT_LOCKS  8
+int			NumXLogInsertLocks = -1;
 
 /*
  * Max distance from last checkpoint, before triggering a new xlog-based
@@ -838,8 +840,8 @@ XLogInsertRecord(XLogRecData *rdata,
 	 * To keep track of which insertions are still in-progress, each concurrent
 	 * inserter acquires an insertion lock. In addition to just indicating that
 	 * an insertion is in progress, the lock tells others how far the inserter
-	 * has progressed. There is a small fixed number of insertion locks,
-	 * determined by NUM_XLOGINSERT_LOCKS. When an inserter crosses a page
+	 * has progressed. There is a small number of insertion locks,
+	 * determined by wal_insert_locks. When an inserter crosses a page
 	 * boundary, it updates the value stored in the lock to the how far it has
 	 * inserted, to allow the previous buffer to be flushed.
 	 *
@@ -1427,7 +1429,7 @@ WALInsertLockAcquire(void)
 	static int	lockToTry = -1;
 
 	if (lockToTry == -1)
-		lockToTry = MyProcNumber % NUM_XLOGINSERT_LOCKS;
+		lockToTry = MyProcNumber % NumXLogInsertLocks;
 	MyLockNo = lockToTry;
 
 	/*
@@ -1445,13 +1447,16 @@ WALInsertLockAcquire(void)
 		 * than locks, it still helps to distribute the inserters evenly
 		 * across the locks.
 		 */
-		lockToTry = (lockToTry + 1) % NUM_XLOGINSERT_LOCKS;
+		lockToTry = (lockToTry + 1) % NumXLogInsertLocks;
 	}
 }
 
 /*
  * Acquire all WAL insertion locks, to prevent other backends from inserting
  * to WAL.
+ *
+ * This holds NumXLogInsertLocks LWLocks at once, which must stay well below
+ * MAX_SIMUL_LWLOCKS; that is why wal_insert_locks is capped at 128.
  */
 static void
 WALInsertLockAcquireExclusive(void)
@@ -1463,7 +1468,7 @@ WALInsertLockAcquireExclusive(void)
 	 * indicator is set to 0xFFFFFFFFFFFFFFFF, which is higher than any real
 	 * XLogRecPtr value, to make sure that no-one blocks waiting on those.
 	 */
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS - 1; i++)
+	for (i = 0; i < NumXLogInsertLocks - 1; i++)
 	{
 		LWLockAcquire(&WALInsertLocks[i].l.lock, LW_EXCLUSIVE);
 		LWLockUpdateVar(&WALInsertLocks[i].l.lock,
@@ -1489,7 +1494,7 @@ WALInsertLockRelease(void)
 	{
 		int			i;
 
-		for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+		for (i = 0; i < NumXLogInsertLocks; i++)
 			LWLockReleaseClearVar(&WALInsertLocks[i].l.lock,
 								  &WALInsertLocks[i].l.insertingAt,
 								  0);
@@ -1517,8 +1522,8 @@ WALInsertLockUpdateInsertingAt(XLogRecPtr insertingAt)
 		 * We use the last lock to mark our actual position, see comments in
 		 * WALInsertLockAcquireExclusive.
 		 */
-		LWLockUpdateVar(&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.lock,
-						&WALInsertLocks[NUM_XLOGINSERT_LOCKS - 1].l.insertingAt,
+		LWLockUpdateVar(&WALInsertLocks[NumXLogInsertLocks - 1].l.lock,
+						&WALInsertLocks[NumXLogInsertLocks - 1].l.insertingAt,
 						insertingAt);
 	}
 	else
@@ -1594,7 +1599,7 @@ WaitXLogInsertionsToFinish(XLogRecPtr upto)
 	 * out for any insertion that's still in progress.
 	 */
 	finishedUpto = reservedUpto;
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	insertingat = InvalidXLogRecPtr;
 
@@ -2329,7 +2334,8 @@ XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible)
 	bool		finishing_seg;
 	int			curridx;
 	int			npages;
-	int			startidx;
+	struct iovec iov[2];
+	int			iovcnt;
 	uint32		startoffset;
 
 	/* We should always be inside a critical section here */
@@ -2344,13 +2350,15 @@ XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible)
 	 * Since successive pages in the xlog cache are consecutively allocated,
 	 * we can usually gather multiple pages together and issue just one
 	 * write() call.  npages is the number of pages we have determined can be
-	 * written together; startidx is the cache block index of the first one,
-	 * and startoffset is the file offset at which it should go. The latter
-	 * two variables are only valid when npages > 0, but we must initialize
-	 * all of them to keep the compiler quiet.
+	 * written together; iov describes where they are in the cache, and
+	 * startoffset is the file offset at which they should go.  A group that
+	 * wraps around the end of the cache needs a second iovec for the pages
+	 * at its start, but can still be written with a single pwritev() call.
+	 * The latter variables are only valid when npages > 0, but we must
+	 * initialize all of them to keep the compiler quiet.
 	 */
 	npages = 0;
-	startidx = 0;
+	iovcnt = 0;
 	startoffset = 0;
 
 	/*
@@ -2411,17 +2419,27 @@ XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible)
 		if (npages == 0)
 		{
 			/* first of group */
-			startidx = curridx;
+			iov[0].iov_base = XLogCtl->pages + curridx * (Size) XLOG_BLCKSZ;
+			iov[0].iov_len = 0;
+			iovcnt = 1;
 			startoffset = XLogSegmentOffset(LogwrtResult.Write - XLOG_BLCKSZ,
 											wal_segment_size);
 		}
+		else if (curridx == 0)
+		{
+			/* group wrapped around the end of the cache */
+			iov[1].iov_base = XLogCtl->pages;
+			iov[1].iov_len = 0;
+			iovcnt = 2;
+		}
+		iov[iovcnt - 1].iov_len += XLOG_BLCKSZ;
 		npages++;
 
 		/*
 		 * Dump the set if this will be the last loop iteration, or if we are
-		 * at the last page of the cache area (since the next page won't be
-		 * contiguous in memory), or if we are at the end of the logfile
-		 * segment.
+		 * at the last page of the cache area and continuing would need a
+		 * third chunk or revisit the group's first page, or if we are at the
+		 * end of the logfile segment.
 		 */
 		last_iteration = WriteRqst.Write <= LogwrtResult.Write;
 
@@ -2429,19 +2447,16 @@ XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible)
 			(startoffset + npages * XLOG_BLCKSZ) >= wal_segment_size;
 
 		if (last_iteration ||
-			curridx == XLogCtl->XLogCacheBlck ||
+			(curridx == XLogCtl->XLogCacheBlck &&
+			 (iovcnt == lengthof(iov) || iov[0].iov_base == XLogCtl->pages)) ||
 			finishing_seg)
 		{
-			char	   *from;
-			Size		nbytes;
 			Size		nleft;
 			ssize_t		written;
 			instr_time	start;
 
 			/* OK to write the page(s) */
-			from = XLogCtl->pages + startidx * (Size) XLOG_BLCKSZ;
-			nbytes = npages * (Size) XLOG_BLCKSZ;
-			nleft = nbytes;
+			nleft = npages * (Size) XLOG_BLCKSZ;
 			do
 			{
 				errno = 0;
@@ -2452,7 +2467,7 @@ XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible)
 				start = pgstat_prepare_io_time(track_wal_io_timing);
 
 				pgstat_report_wait_start(WAIT_EVENT_WAL_WRITE);
-				written = pg_pwrite(openLogFile, from, nleft, startoffset);
+				written = pg_pwritev(openLogFile, iov, iovcnt, startoffset);
 				pgstat_report_wait_end();
 
 				pgstat_count_io_op_time(IOOBJECT_WAL, IOCONTEXT_NORMAL,
@@ -2476,8 +2491,9 @@ XLogWrite(XLogwrtRqst WriteRqst, TimeLineID tli, bool flexible)
 									xlogfname, startoffset, nleft)));
 				}
 				nleft -= written;
-				from += written;
 				startoffset += written;
+				if (nleft > 0)
+					iovcnt = compute_remaining_iovec(iov, iov, iovcnt, written);
 			} while (nleft > 0);
 
 			npages = 0;
@@ -2796,6 +2812,15 @@ UpdateMinRecoveryPoint(XLogRecPtr lsn, bool force)
  *
  * NOTE: this differs from XLogWrite mainly in that the WALWriteLock is not
  * already held, and we try to avoid acquiring it if possible.
+ *
+ * Concurrent committers are grouped without a dedicated flusher process: the
+ * backend that gets WALWriteLock acts as the leader and flushes everything
+ * inserted so far, while the others sleep in LWLockAcquireOrWait() and, once
+ * woken, usually find that their record has been flushed on their behalf.
+ * Handing the flush to another process instead would add a process switch
+ * to every commit's latency, which is what we are trying to minimize when
+ * fsync itself is cheap.  commit_delay can be used to make the groups
+ * larger when fsync is expensive.
  */
 void
 XLogFlush(XLogRecPtr record)
@@ -5034,6 +5059,59 @@ XLOGChooseNumBuffers(void)
 	return xbuffers;
 }
 
+/*
+ * Auto-tune the number of WAL insertion locks.
+ *
+ * Contention on the insertion locks grows with the number of backends that
+ * can insert WAL concurrently, so allow one lock for every 16 connections.
+ * We never go below the historical value of 8, and cap the automatic value
+ * to keep the cost of WaitXLogInsertionsToFinish() in check.
+ */
+static int
+XLOGChooseNumInsertLocks(void)
+{
+	int			nlocks;
+
+	nlocks = MaxConnections / 16;
+	if (nlocks > 64)
+		nlocks = 64;
+	if (nlocks < 8)
+		nlocks = 8;
+	return nlocks;
+}
+
+/*
+ * GUC check_hook for wal_insert_locks
+ */
+bool
+check_wal_insert_locks(int *newval, void **extra, GucSource source)
+{
+	/*
+	 * -1 indicates a request for auto-tune.
+	 */
+	if (*newval == -1)
+	{
+		/*
+		 * If we haven't yet changed the boot_val default of -1, just let it
+		 * be.  We'll fix it when XLOGShmemRequest is called.
+		 */
+		if (NumXLogInsertLocks == -1)
+			return true;
+
+		/* Otherwise, substitute the auto-tune value */
+		*newval = XLOGChooseNumInsertLocks();
+	}
+
+	if (*newval == 0)
+	{
+		GUC_check_errdetail("\"%s\" must be -1 or at least 1.",
+							"wal_insert_locks");
+		return false;
+	}
+
+	return true;
+}
+
 /*
  * GUC check_hook for wal_buffers
  */
@@ -5320,11 +5398,25 @@ XLOGShmemRequest(void *arg)
 	}
 	Assert(XLOGbuffers > 0);
 
+	/* Likewise for wal_insert_locks, which depends on max_connections */
+	if (NumXLogInsertLocks == -1)
+	{
+		char		buf[32];
+
+		snprintf(buf, sizeof(buf), "%d", XLOGChooseNumInsertLocks());
+		SetConfigOption("wal_insert_locks", buf, PGC_POSTMASTER,
+						PGC_S_DYNAMIC_DEFAULT);
+		if (NumXLogInsertLocks == -1)	/* failed to apply it? */
+			SetConfigOption("wal_insert_locks", buf, PGC_POSTMASTER,
+							PGC_S_OVERRIDE);
+	}
+	Assert(NumXLogInsertLocks > 0);
+
 	/* XLogCtl */
 	size = sizeof(XLogCtlData);
 
 	/* WAL insertion locks, plus alignment */
-	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NUM_XLOGINSERT_LOCKS + 1));
+	size = add_size(size, mul_size(sizeof(WALInsertLockPadded), NumXLogInsertLocks + 1));
 	/* xlblocks array */
 	size = add_size(size, mul_size(sizeof(pg_atomic_uint64), XLOGbuffers));
 	/* extra alignment padding for XLOG I/O buffers */
@@ -5399,9 +5491,9 @@ XLOGShmemInit(void *arg)
 		((uintptr_t) allocptr) % sizeof(WALInsertLockPadded);
 	WALInsertLocks = XLogCtl->Insert.WALInsertLocks =
 		(WALInsertLockPadded *) allocptr;
-	allocptr += sizeof(WALInsertLockPadded) * NUM_XLOGINSERT_LOCKS;
+	allocptr += sizeof(WALInsertLockPadded) * NumXLogInsertLocks;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		LWLockInitialize(&WALInsertLocks[i].l.lock, LWTRANCHE_WAL_INSERT);
 		pg_atomic_init_u64(&WALInsertLocks[i].l.insertingAt, InvalidXLogRecPtr);
@@ -7056,7 +7148,7 @@ GetLastImportantRecPtr(void)
 	XLogRecPtr	res = InvalidXLogRecPtr;
 	int			i;
 
-	for (i = 0; i < NUM_XLOGINSERT_LOCKS; i++)
+	for (i = 0; i < NumXLogInsertLocks; i++)
 	{
 		XLogRecPtr	last_important;
 
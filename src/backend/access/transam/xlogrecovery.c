@@ -1785,14 +1785,11 @@ PerformWalRecovery(void)
 			 * Wake up processes waiting for standby replay, write, or flush
 			 * LSN to reach current replay position.  Replay implies that the
 			 * WAL was already written and flushed to disk, so write and flush
-			 * waiters can be woken at the replay position too.
+			 * waiters can be woken at the replay position too.  Redo is
+			 * single-threaded, so this is done with a single combined
+			 * fast-path check to keep the per-record overhead low.
 			 */
-			WaitLSNWakeup(WAIT_LSN_TYPE_STANDBY_REPLAY,
-						  XLogRecoveryCtl->lastReplayedEndRecPtr);
-			WaitLSNWakeup(WAIT_LSN_TYPE_STANDBY_WRITE,
-						  XLogRecoveryCtl->lastReplayedEndRecPtr);
-			WaitLSNWakeup(WAIT_LSN_TYPE_STANDBY_FLUSH,
-						  XLogRecoveryCtl->lastReplayedEndRecPtr);
+			WaitLSNWakeupStandby(XLogRecoveryCtl->lastReplayedEndRecPtr);
 
 			/* Exit loop if we reached inclusive recovery target */
 			if (recoveryStopsAfter(xlogreader))
@@ -359,6 +359,32 @@ WaitLSNWakeup(WaitLSNType lsnType, XLogRecPtr currentLSN)
 	wakeupWaiters(lsnType, currentLSN);
 }
 
+/*
+ * Wake up processes waiting for the standby replay, write, or flush LSN to
+ * reach currentLSN.
+ *
+ * This is called by the startup process after every replayed record, so it
+ * is on the critical path of (single-threaded) redo.  It is equivalent to
+ * calling WaitLSNWakeup() for each of the three standby wait types, but
+ * issues a single memory barrier for the fast-path checks instead of one per
+ * type.
+ */
+void
+WaitLSNWakeupStandby(XLogRecPtr currentLSN)
+{
+	Assert(XLogRecPtrIsValid(currentLSN));
+
+	/* Pairs with pg_atomic_write_membarrier_u64() in updateMinWaitedLSN(). */
+	pg_memory_barrier();
+
+	if (pg_atomic_read_u64(&waitLSNState->minWaitedLSN[WAIT_LSN_TYPE_STANDBY_REPLAY]) <= currentLSN)
+		wakeupWaiters(WAIT_LSN_TYPE_STANDBY_REPLAY, currentLSN);
+	if (pg_atomic_read_u64(&waitLSNState->minWaitedLSN[WAIT_LSN_TYPE_STANDBY_WRITE]) <= currentLSN)
+		wakeupWaiters(WAIT_LSN_TYPE_STANDBY_WRITE, currentLSN);
+	if (pg_atomic_read_u64(&waitLSNState->minWaitedLSN[WAIT_LSN_TYPE_STANDBY_FLUSH]) <= currentLSN)
+		wakeupWaiters(WAIT_LSN_TYPE_STANDBY_FLUSH, currentLSN);
+}
+
 /*
  * Clean up any LSN wait state for the current process.
  */
@@ -3040,7 +3040,8 @@ index_build(Relation heapRelation,
 
 	/*
 	 * Determine worker process details for parallel CREATE INDEX.  Currently,
-	 * only btree, GIN, and BRIN have support for parallel builds.
+	 * only btree, GIN, BRIN, and GiST (sorted builds only) have support for
+	 * parallel builds.
 	 *
 	 * Note that planner considers parallel safety for us.
 	 */
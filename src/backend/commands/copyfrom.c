@@ -9,6 +9,15 @@
  * Reading data from the input file or client and parsing it into Datums
  * is handled in copyfromparse.c.
  *
+ * COPY FROM runs entirely in the leader backend.  Splitting the input at line
+ * boundaries and handing chunks to parallel workers for parsing and insertion
+ * is not possible yet: heap_prepare_insert() refuses to insert tuples in a
+ * parallel worker, and constraint and trigger evaluation in workers would
+ * also need to be proven parallel-safe.  Until that infrastructure exists,
+ * throughput depends on keeping the per-row work here and in copyfromparse.c
+ * cheap, which is why rows are buffered and inserted in batches via
+ * table_multi_insert() whenever possible.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
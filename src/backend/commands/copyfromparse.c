@@ -147,6 +147,13 @@ static bool CopyReadLine(CopyFromState cstate, bool is_csv);
 static pg_attribute_always_inline bool CopyReadLineText(CopyFromState cstate,
 														bool is_csv);
 static int	CopyReadAttributesText(CopyFromState cstate);
+#ifndef USE_NO_SIMD
+static pg_attribute_always_inline void CopyReadAttributeSkipSIMD(char **cur_ptr_p,
+																 char **output_ptr_p,
+																 const char *line_end_ptr,
+																 Vector8 c1_vec,
+																 Vector8 c2_vec);
+#endif
 static int	CopyReadAttributesCSV(CopyFromState cstate);
 static Datum CopyReadBinaryAttribute(CopyFromState cstate, FmgrInfo *flinfo,
 									 Oid typioparam, int32 typmod,
@@ -1806,6 +1813,74 @@ GetDecimalFromHex(char hex)
 		return pg_ascii_tolower((unsigned char) hex) - 'a' + 10;
 }
 
+#ifndef USE_NO_SIMD
+/*
+ * Is there enough input left on the line for CopyReadAttributeSkipSIMD() to
+ * examine at least one chunk?
+ */
+#define COPY_SIMD_WORTHWHILE(cur_ptr, line_end_ptr) \
+	((line_end_ptr) - (cur_ptr) >= (ptrdiff_t) sizeof(Vector8))
+
+/*
+ * Helper for CopyReadAttributesText() and CopyReadAttributesCSV() that uses
+ * SIMD instructions to copy runs of ordinary bytes from the input line to the
+ * output area.
+ *
+ * The input is examined sizeof(Vector8) bytes at a time.  Chunks that don't
+ * contain c1 or c2 are copied as-is; when a chunk does contain one of them,
+ * only the bytes before it are consumed, leaving *cur_ptr_p pointing at the
+ * special byte for the caller's scalar loop to handle.  We also stop when
+ * less than a full chunk of input remains.
+ *
+ * Callers check COPY_SIMD_WORTHWHILE first, so that the tail of each line,
+ * shorter than a chunk, is left to the scalar loop without further ado.
+ * Short fields still go through here when more input follows them on the
+ * line: one chunk usually covers the whole field and finds its delimiter,
+ * which is cheaper than examining the field byte by byte.
+ *
+ * Each chunk is copied in full even when only part of it is consumed.  That's
+ * safe because the output is never longer than the input consumed so far (see
+ * the comments about attribute_buf in the callers), and any bytes written
+ * past *output_ptr_p will be overwritten or lie beyond the final length.
+ */
+static pg_attribute_always_inline void
+CopyReadAttributeSkipSIMD(char **cur_ptr_p, char **output_ptr_p,
+						  const char *line_end_ptr,
+						  Vector8 c1_vec, Vector8 c2_vec)
+{
+	char	   *cur_ptr = *cur_ptr_p;
+	char	   *output_ptr = *output_ptr_p;
+
+	while (line_end_ptr - cur_ptr >= (ptrdiff_t) sizeof(Vector8))
+	{
+		Vector8		chunk;
+		Vector8		match;
+
+		vector8_load(&chunk, (const uint8 *) cur_ptr);
+		memcpy(output_ptr, cur_ptr, sizeof(Vector8));
+
+		match = vector8_or(vector8_eq(chunk, c1_vec),
+						   vector8_eq(chunk, c2_vec));
+		if (vector8_is_highbit_set(match))
+		{
+			int			advance;
+
+			advance = pg_rightmost_one_pos32(vector8_highbit_mask(match));
+			cur_ptr += advance;
+			output_ptr += advance;
+			break;
+		}
+
+		/* That chunk was clear of special characters, so we can skip it. */
+		cur_ptr += sizeof(Vector8);
+		output_ptr += sizeof(Vector8);
+	}
+
+	*cur_ptr_p = cur_ptr;
+	*output_ptr_p = output_ptr;
+}
+#endif							/* ! USE_NO_SIMD */
+
 /*
  * Parse the current line into separate attributes (fields),
  * performing de-escaping as needed.
@@ -1833,6 +1908,10 @@ CopyReadAttributesText(CopyFromState cstate)
 	char	   *output_ptr;
 	char	   *cur_ptr;
 	char	   *line_end_ptr;
+#ifndef USE_NO_SIMD
+	const Vector8 delim_vec = vector8_broadcast(delimc);
+	const Vector8 bs_vec = vector8_broadcast('\\');
+#endif
 
 	/*
 	 * We need a special case for zero-column tables: check that the input
@@ -1901,6 +1980,13 @@ CopyReadAttributesText(CopyFromState cstate)
 		{
 			char		c;
 
+#ifndef USE_NO_SIMD
+			/* Quickly copy over bytes that are neither delimiter nor '\\' */
+			if (COPY_SIMD_WORTHWHILE(cur_ptr, line_end_ptr))
+				CopyReadAttributeSkipSIMD(&cur_ptr, &output_ptr, line_end_ptr,
+										  delim_vec, bs_vec);
+#endif
+
 			end_ptr = cur_ptr;
 			if (cur_ptr >= line_end_ptr)
 				break;
@@ -2089,6 +2175,11 @@ CopyReadAttributesCSV(CopyFromState cstate)
 	char	   *output_ptr;
 	char	   *cur_ptr;
 	char	   *line_end_ptr;
+#ifndef USE_NO_SIMD
+	const Vector8 delim_vec = vector8_broadcast(delimc);
+	const Vector8 quote_vec = vector8_broadcast(quotec);
+	const Vector8 esc_vec = vector8_broadcast(escapec);
+#endif
 
 	/*
 	 * We need a special case for zero-column tables: check that the input
@@ -2156,6 +2247,13 @@ CopyReadAttributesCSV(CopyFromState cstate)
 			/* Not in quote */
 			for (;;)
 			{
+#ifndef USE_NO_SIMD
+				/* Quickly copy over bytes that are neither delimiter nor quote */
+				if (COPY_SIMD_WORTHWHILE(cur_ptr, line_end_ptr))
+					CopyReadAttributeSkipSIMD(&cur_ptr, &output_ptr, line_end_ptr,
+											  delim_vec, quote_vec);
+#endif
+
 				end_ptr = cur_ptr;
 				if (cur_ptr >= line_end_ptr)
 					goto endfield;
@@ -2179,6 +2277,13 @@ CopyReadAttributesCSV(CopyFromState cstate)
 			/* In quote */
 			for (;;)
 			{
+#ifndef USE_NO_SIMD
+				/* Quickly copy over bytes that are neither escape nor quote */
+				if (COPY_SIMD_WORTHWHILE(cur_ptr, line_end_ptr))
+					CopyReadAttributeSkipSIMD(&cur_ptr, &output_ptr, line_end_ptr,
+											  esc_vec, quote_vec);
+#endif
+
 				end_ptr = cur_ptr;
 				if (cur_ptr >= line_end_ptr)
 					ereport(ERROR,
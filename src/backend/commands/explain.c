@@ -3412,7 +3412,9 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 	 * parallel-aware case, we need to consider all the results.  Each worker
 	 * may have seen a different subset of batches and we want to report the
 	 * highest memory usage across all batches.  We take the maxima of other
-	 * values too, for the same reasons as in ExecHashAccumInstrumentation.
+	 * values too, for the same reasons as in ExecHashAccumInstrumentation,
+	 * except that Bloom filter rejections are summed because each participant
+	 * scanned different outer tuples.
 	 */
 	if (hashstate->shared_info)
 	{
@@ -3433,6 +3435,9 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 											  worker_hi->nbatch_original);
 			hinstrument.space_peak = Max(hinstrument.space_peak,
 										 worker_hi->space_peak);
+			hinstrument.bloom_space = Max(hinstrument.bloom_space,
+										  worker_hi->bloom_space);
+			hinstrument.bloom_rejected += worker_hi->bloom_rejected;
 		}
 	}
 
@@ -3474,6 +3479,27 @@ show_hash_info(HashState *hashstate, ExplainState *es)
 							 spacePeakKb);
 		}
 	}
+
+	if (hinstrument.bloom_space > 0)
+	{
+		uint64		bloomSpaceKb = BYTES_TO_KILOBYTES(hinstrument.bloom_space);
+
+		if (es->format != EXPLAIN_FORMAT_TEXT)
+		{
+			ExplainPropertyUInteger("Bloom Filter Memory Usage", "kB",
+									bloomSpaceKb, es);
+			ExplainPropertyInteger("Bloom Filter Rejected Rows", NULL,
+								   hinstrument.bloom_rejected, es);
+		}
+		else
+		{
+			ExplainIndentText(es);
+			appendStringInfo(es->str,
+							 "Bloom Filter: Rejected Rows: " INT64_FORMAT "  Memory Usage: " UINT64_FORMAT "kB\n",
+							 hinstrument.bloom_rejected,
+							 bloomSpaceKb);
+		}
+	}
 }
 
 /*
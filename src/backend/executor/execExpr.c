@@ -47,6 +47,7 @@
 #include "utils/acl.h"
 #include "utils/array.h"
 #include "utils/builtins.h"
+#include "utils/fmgroids.h"
 #include "utils/jsonfuncs.h"
 #include "utils/jsonpath.h"
 #include "utils/lsyscache.h"
@@ -4091,6 +4092,11 @@ ExecBuildAggTransCall(ExprState *state, AggState *aggstate,
 	 * Otherwise we call EEOP_AGG_PLAIN_TRANS{,_BYVAL}, which does not have to
 	 * perform either of the above checks.
 	 *
+	 * As a special case, count(*) and count(any) use EEOP_AGG_PLAIN_TRANS_COUNT,
+	 * which increments the transition value without calling int8inc().  Their
+	 * transition functions are strict with a non-NULL initial value, so the
+	 * step only needs the strictness check of the STRICT variant.
+	 *
 	 * Having steps with overlapping responsibilities is not nice, but
 	 * aggregations are very performance sensitive, making this worthwhile.
 	 *
@@ -4109,6 +4115,10 @@ ExecBuildAggTransCall(ExprState *state, AggState *aggstate,
 			if (fcinfo->flinfo->fn_strict &&
 				pertrans->initValueIsNull)
 				scratch->opcode = EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYVAL;
+			else if (fcinfo->flinfo->fn_strict &&
+					 (fcinfo->flinfo->fn_oid == F_INT8INC ||
+					  fcinfo->flinfo->fn_oid == F_INT8INC_ANY))
+				scratch->opcode = EEOP_AGG_PLAIN_TRANS_COUNT;
 			else if (fcinfo->flinfo->fn_strict)
 				scratch->opcode = EEOP_AGG_PLAIN_TRANS_STRICT_BYVAL;
 			else
@@ -60,6 +60,7 @@
 #include "access/tupconvert.h"
 #include "catalog/pg_type.h"
 #include "commands/sequence.h"
+#include "common/int.h"
 #include "executor/execExpr.h"
 #include "executor/nodeSubplan.h"
 #include "funcapi.h"
@@ -595,6 +596,7 @@ ExecInterpExpr(ExprState *state, ExprContext *econtext, bool *isnull)
 		&&CASE_EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYVAL,
 		&&CASE_EEOP_AGG_PLAIN_TRANS_STRICT_BYVAL,
 		&&CASE_EEOP_AGG_PLAIN_TRANS_BYVAL,
+		&&CASE_EEOP_AGG_PLAIN_TRANS_COUNT,
 		&&CASE_EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYREF,
 		&&CASE_EEOP_AGG_PLAIN_TRANS_STRICT_BYREF,
 		&&CASE_EEOP_AGG_PLAIN_TRANS_BYREF,
@@ -2180,6 +2182,36 @@ ExecInterpExpr(ExprState *state, ExprContext *econtext, bool *isnull)
 			EEO_NEXT();
 		}
 
+		/*
+		 * Transition step for count(*) and count(any), i.e. int8inc() and
+		 * int8inc_any().  These are by far the most common aggregates, so
+		 * increment the transition value inline rather than going through
+		 * the function call machinery for every input row.  Strict input
+		 * checks, if any, have already been performed by earlier steps.
+		 */
+		EEO_CASE(EEOP_AGG_PLAIN_TRANS_COUNT)
+		{
+			AggState   *aggstate = castNode(AggState, state->parent);
+			AggStatePerGroup pergroup =
+				&aggstate->all_pergroups[op->d.agg_trans.setoff][op->d.agg_trans.transno];
+
+			Assert(op->d.agg_trans.pertrans->transtypeByVal);
+
+			if (likely(!pergroup->transValueIsNull))
+			{
+				int64		result;
+
+				if (unlikely(pg_add_s64_overflow(DatumGetInt64(pergroup->transValue),
+												 1, &result)))
+					ereport(ERROR,
+							(errcode(ERRCODE_NUMERIC_VALUE_OUT_OF_RANGE),
+							 errmsg("bigint out of range")));
+				pergroup->transValue = Int64GetDatum(result);
+			}
+
+			EEO_NEXT();
+		}
+
 		/* see comments above EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYVAL */
 		EEO_CASE(EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYREF)
 		{
@@ -197,6 +197,11 @@ MultiExecPrivateHash(HashState *node)
 				ExecHashTableInsert(hashtable, slot, hashvalue);
 			}
 			hashtable->totalTuples += 1;
+
+			if (hashtable->bloomFilter)
+				bloom_add_element(hashtable->bloomFilter,
+								  (unsigned char *) &hashvalue,
+								  sizeof(hashvalue));
 		}
 		else if (node->keep_null_tuples)
 		{
@@ -213,6 +218,20 @@ MultiExecPrivateHash(HashState *node)
 	if (hashtable->nbuckets != hashtable->nbuckets_optimal)
 		ExecHashIncreaseNumBuckets(hashtable);
 
+	/*
+	 * If the inner side turned out much larger than estimated, the Bloom
+	 * filter will be too saturated to reject many outer tuples.  Don't waste
+	 * cycles probing it in that case.
+	 */
+	if (hashtable->bloomFilter &&
+		bloom_prop_bits_set(hashtable->bloomFilter) > 0.5)
+	{
+		bloom_free(hashtable->bloomFilter);
+		hashtable->bloomFilter = NULL;
+		hashtable->spaceUsed -= hashtable->bloomSpace;
+		hashtable->bloomSpace = 0;
+	}
+
 	/* Account for the buckets in spaceUsed (reported in EXPLAIN ANALYZE) */
 	hashtable->spaceUsed += hashtable->nbuckets * sizeof(HashJoinTuple);
 	if (hashtable->spaceUsed > hashtable->spacePeak)
@@ -537,6 +556,9 @@ ExecHashTableCreate(HashState *state)
 	hashtable->skewTuples = 0;
 	hashtable->innerBatchFile = NULL;
 	hashtable->outerBatchFile = NULL;
+	hashtable->bloomFilter = NULL;
+	hashtable->bloomSpace = 0;
+	hashtable->bloomRejected = 0;
 	hashtable->spaceUsed = 0;
 	hashtable->spacePeak = 0;
 	hashtable->spaceAllowed = space_allowed;
@@ -971,6 +993,63 @@ ExecChooseHashTableSize(double ntuples, int tupwidth, bool useskew,
 }
 
 
+/* ----------------------------------------------------------------
+ *		ExecHashTableEnableBloomFilter
+ *
+ *		Arrange for a Bloom filter over the inner hash values to be built
+ *		while the hash table is loaded.  The caller must be prepared to
+ *		discard outer tuples without a match, since that is all the filter
+ *		can be used for.
+ * ----------------------------------------------------------------
+ */
+void
+ExecHashTableEnableBloomFilter(HashState *node)
+{
+	HashJoinTable hashtable = node->hashtable;
+	Plan	   *outerNode = outerPlan(node->ps.plan);
+	MemoryContext oldcxt;
+	Size		budget;
+
+	Assert(hashtable->bloomFilter == NULL);
+
+	/*
+	 * The filter only saves work for outer tuples that would otherwise be
+	 * written to a batch file, and Parallel Hash does not maintain one.
+	 */
+	if (hashtable->parallel_state != NULL || hashtable->nbatch <= 1)
+		return;
+
+	/*
+	 * Let the filter use at most a quarter of the memory the hash table has
+	 * left.  bloom_create() never makes the bitset smaller than 1MB, and
+	 * never larger than the limit we pass it unless that is less than 1MB, so
+	 * give up if the budget can't accommodate the smallest filter.
+	 */
+	if (hashtable->spaceUsed >= hashtable->spaceAllowed)
+		return;
+	budget = (hashtable->spaceAllowed - hashtable->spaceUsed) / 4;
+	budget = Min(budget, MaxAllocSize / 2);
+	if (budget < 1024 * 1024)
+		return;
+
+	/* Size the filter for the estimated number of inner rows */
+	oldcxt = MemoryContextSwitchTo(hashtable->hashCxt);
+	hashtable->bloomFilter =
+		bloom_create((int64) Max(outerNode->plan_rows, 1.0),
+					 (int) (budget / 1024),
+					 0);
+	MemoryContextSwitchTo(oldcxt);
+
+	/*
+	 * Charge the filter against spaceAllowed, so that the tuples must fit in
+	 * what remains, and include it in the peak reported by EXPLAIN ANALYZE.
+	 */
+	hashtable->bloomSpace = GetMemoryChunkSpace(hashtable->bloomFilter);
+	hashtable->spaceUsed += hashtable->bloomSpace;
+	if (hashtable->spaceUsed > hashtable->spacePeak)
+		hashtable->spacePeak = hashtable->spaceUsed;
+}
+
 /* ----------------------------------------------------------------
  *		ExecHashTableDestroy
  *
@@ -2355,6 +2434,16 @@ ExecHashTableReset(HashJoinTable hashtable)
 	MemoryContext oldcxt;
 	int			nbuckets = hashtable->nbuckets;
 
+	/*
+	 * The Bloom filter is only consulted while the outer relation is being
+	 * partitioned, which is finished once we move on to a later batch.
+	 */
+	if (hashtable->bloomFilter)
+	{
+		bloom_free(hashtable->bloomFilter);
+		hashtable->bloomFilter = NULL;
+	}
+
 	/*
 	 * Release all the hash buckets and tuples acquired in the prior pass, and
 	 * reinitialize the context for a new pass.
@@ -2929,7 +3018,9 @@ ExecHashRetrieveInstrumentation(HashState *node)
  * the largest spacePeak regardless of whether it happened in the same
  * instance as the largest nbuckets or nbatch.  All the instances should have
  * the same nbuckets_original and nbatch_original; but there's little value
- * in depending on that here, so handle them the same way.
+ * in depending on that here, so handle them the same way.  The number of
+ * outer tuples rejected by the Bloom filter is summed instead, since each
+ * instance saw different outer tuples.
  */
 void
 ExecHashAccumInstrumentation(HashInstrumentation *instrument,
@@ -2945,6 +3036,9 @@ ExecHashAccumInstrumentation(HashInstrumentation *instrument,
 									  hashtable->nbatch_original);
 	instrument->space_peak = Max(instrument->space_peak,
 								 hashtable->spacePeak);
+	instrument->bloom_space = Max(instrument->bloom_space,
+								  hashtable->bloomSpace);
+	instrument->bloom_rejected += hashtable->bloomRejected;
 }
 
 /*
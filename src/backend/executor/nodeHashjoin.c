@@ -345,6 +345,16 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 				 * arrived too late.
 				 */
 				hashNode->hashtable = hashtable;
+
+				/*
+				 * If unmatched outer tuples never need to be emitted, a Bloom
+				 * filter over the inner hash values lets us throw away outer
+				 * tuples that cannot match, rather than spilling them to an
+				 * outer batch file only to find no partner later.
+				 */
+				if (!parallel && !HJ_FILL_OUTER(node))
+					ExecHashTableEnableBloomFilter(hashNode);
+
 				(void) MultiExecProcNode((PlanState *) hashNode);
 
 				/*
@@ -508,8 +518,23 @@ ExecHashJoinImpl(PlanState *pstate, bool parallel)
 					node->hj_CurSkewBucketNo == INVALID_SKEW_BUCKET_NO)
 				{
 					bool		shouldFree;
-					MinimalTuple mintuple = ExecFetchSlotMinimalTuple(outerTupleSlot,
-																	  &shouldFree);
+					MinimalTuple mintuple;
+
+					/*
+					 * No point in saving a tuple that the Bloom filter says
+					 * has no inner partner in any batch.
+					 */
+					if (hashtable->bloomFilter &&
+						bloom_lacks_element(hashtable->bloomFilter,
+											(unsigned char *) &hashvalue,
+											sizeof(hashvalue)))
+					{
+						hashtable->bloomRejected++;
+						continue;
+					}
+
+					mintuple = ExecFetchSlotMinimalTuple(outerTupleSlot,
+														 &shouldFree);
 
 					/*
 					 * Need to postpone this outer tuple to a later batch.
@@ -44,6 +44,7 @@
 #include "utils/lsyscache.h"
 #include "utils/rel.h"
 #include "utils/sortsupport.h"
+#include "utils/spccache.h"
 
 /*
  * When an ordering operator is used, tuples fetched from the index that
@@ -118,6 +119,7 @@ IndexNext(IndexScanState *node)
 								   SO_HINT_REL_READ_ONLY : SO_NONE);
 
 		node->iss_ScanDesc = scandesc;
+		scandesc->xs_prefetch_maximum = node->iss_PrefetchMaximum;
 
 		/*
 		 * If no run-time keys to calculate or they are ready, go ahead and
@@ -216,6 +218,7 @@ IndexNextWithReorder(IndexScanState *node)
 								   SO_HINT_REL_READ_ONLY : SO_NONE);
 
 		node->iss_ScanDesc = scandesc;
+		scandesc->xs_prefetch_maximum = node->iss_PrefetchMaximum;
 
 		/*
 		 * If no run-time keys to calculate or they are ready, go ahead and
@@ -986,6 +989,20 @@ ExecInitIndexScan(IndexScan *node, EState *estate, int eflags)
 	lockmode = exec_rt_fetch(node->scan.scanrelid, estate)->rellockmode;
 	indexstate->iss_RelationDesc = index_open(node->indexid, lockmode);
 
+	/*
+	 * Let the index AM prefetch the heap tuples it's about to return, up to
+	 * the heap tablespace's effective_io_concurrency, which is also what
+	 * limits the read stream of a bitmap heap scan.  This is decided here
+	 * rather than by the index AM, since only the executor knows that the
+	 * scan will actually visit the heap.  The index AM backs off by itself
+	 * when the heap blocks turn out to be cached already.
+	 */
+	indexstate->iss_PrefetchMaximum = 0;
+#ifdef USE_PREFETCH
+	indexstate->iss_PrefetchMaximum =
+		get_tablespace_io_concurrency(currentRelation->rd_rel->reltablespace);
+#endif
+
 	/*
 	 * Initialize index-specific scan state
 	 */
@@ -1712,6 +1729,7 @@ ExecIndexScanInitializeDSM(IndexScanState *node,
 								 piscan,
 								 ScanRelIsReadOnly(&node->ss) ?
 								 SO_HINT_REL_READ_ONLY : SO_NONE);
+	node->iss_ScanDesc->xs_prefetch_maximum = node->iss_PrefetchMaximum;
 
 	/*
 	 * If no run-time keys to calculate or they are ready, go ahead and pass
@@ -1760,6 +1778,7 @@ ExecIndexScanInitializeWorker(IndexScanState *node,
 								 piscan,
 								 ScanRelIsReadOnly(&node->ss) ?
 								 SO_HINT_REL_READ_ONLY : SO_NONE);
+	node->iss_ScanDesc->xs_prefetch_maximum = node->iss_PrefetchMaximum;
 
 	/*
 	 * If no run-time keys to calculate or they are ready, go ahead and pass
@@ -304,6 +304,9 @@ llvm_release_context(JitContext *context)
 	list_free(llvm_jit_context->handles);
 	llvm_jit_context->handles = NIL;
 
+	list_free_deep(llvm_jit_context->deform_cache);
+	llvm_jit_context->deform_cache = NIL;
+
 	llvm_leave_fatal_on_oom();
 
 	if (llvm_jit_context->resowner)
@@ -25,10 +25,33 @@
 #include "executor/tuptable.h"
 #include "jit/llvmjit.h"
 #include "jit/llvmjit_emit.h"
+#include "utils/memutils.h"
+
+
+/*
+ * Deform function already generated in a JIT context's current module.
+ *
+ * A query commonly deforms the same slot in several expressions, e.g. in a
+ * scan's qual and its projection.  The generated code only depends on the
+ * tuple descriptor, the slot type and the number of attributes, so the
+ * function generated for the first expression can be called from the others
+ * instead of emitting and optimizing an identical copy each time.
+ */
+typedef struct LLVMJitDeformCacheEntry
+{
+	size_t		module_generation;	/* module containing the function */
+	TupleDesc	desc;
+	const TupleTableSlotOps *ops;
+	int			natts;
+	LLVMValueRef fn;
+} LLVMJitDeformCacheEntry;
 
 
 /*
  * Create a function that deforms a tuple of type desc up to natts columns.
+ *
+ * If an identical function already exists in the context's current module,
+ * it is returned instead.
  */
 LLVMValueRef
 slot_compile_deform(LLVMJitContext *context, TupleDesc desc,
@@ -101,6 +124,24 @@ slot_compile_deform(LLVMJitContext *context, TupleDesc desc,
 	mod = llvm_mutable_module(context);
 	lc = LLVMGetModuleContext(mod);
 
+	/*
+	 * Functions can only be shared within a module, so forget about those
+	 * generated for a module that has since been emitted.
+	 */
+	if (context->deform_cache != NIL &&
+		((LLVMJitDeformCacheEntry *) linitial(context->deform_cache))->module_generation !=
+		context->module_generation)
+	{
+		list_free_deep(context->deform_cache);
+		context->deform_cache = NIL;
+	}
+
+	foreach_ptr(LLVMJitDeformCacheEntry, entry, context->deform_cache)
+	{
+		if (entry->desc == desc && entry->ops == ops && entry->natts == natts)
+			return entry->fn;
+	}
+
 	funcname = llvm_expand_funcname(context, "deform");
 
 	/*
@@ -754,5 +795,21 @@ slot_compile_deform(LLVMJitContext *context, TupleDesc desc,
 
 	LLVMDisposeBuilder(b);
 
+	/* remember the function for later expressions in the same module */
+	{
+		MemoryContext oldcontext;
+		LLVMJitDeformCacheEntry *entry;
+
+		oldcontext = MemoryContextSwitchTo(TopMemoryContext);
+		entry = palloc_object(LLVMJitDeformCacheEntry);
+		entry->module_generation = context->module_generation;
+		entry->desc = desc;
+		entry->ops = ops;
+		entry->natts = natts;
+		entry->fn = v_deform_fn;
+		context->deform_cache = lappend(context->deform_cache, entry);
+		MemoryContextSwitchTo(oldcontext);
+	}
+
 	return v_deform_fn;
 }
@@ -2597,6 +2597,7 @@ llvm_compile_expr(ExprState *state)
 			case EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYVAL:
 			case EEOP_AGG_PLAIN_TRANS_STRICT_BYVAL:
 			case EEOP_AGG_PLAIN_TRANS_BYVAL:
+			case EEOP_AGG_PLAIN_TRANS_COUNT:
 			case EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYREF:
 			case EEOP_AGG_PLAIN_TRANS_STRICT_BYREF:
 			case EEOP_AGG_PLAIN_TRANS_BYREF:
@@ -2715,6 +2716,7 @@ llvm_compile_expr(ExprState *state)
 					if (opcode == EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYVAL ||
 						opcode == EEOP_AGG_PLAIN_TRANS_INIT_STRICT_BYREF ||
 						opcode == EEOP_AGG_PLAIN_TRANS_STRICT_BYVAL ||
+						opcode == EEOP_AGG_PLAIN_TRANS_COUNT ||
 						opcode == EEOP_AGG_PLAIN_TRANS_STRICT_BYREF)
 					{
 						LLVMValueRef v_transnull;
@@ -14,6 +14,7 @@
  */
 #include "postgres.h"
 
+#include "port/pg_numa.h"
 #include "storage/aio.h"
 #include "storage/buf_internals.h"
 #include "storage/bufmgr.h"
@@ -27,9 +28,15 @@ ConditionVariableMinimallyPadded *BufferIOCVArray;
 WritebackContext BackendWritebackContext;
 CkptSortItem *CkptBufferIds;
 
+/* GUC variable */
+bool		numa_interleave_shared_buffers = false;
+
 static void BufferManagerShmemRequest(void *arg);
 static void BufferManagerShmemInit(void *arg);
 static void BufferManagerShmemAttach(void *arg);
+static void BufferManagerInterleaveNuma(void);
+static void InterleaveNumaRange(const char *name, void *ptr, Size size,
+								Size pagesize);
 
 const ShmemCallbacks BufferManagerShmemCallbacks = {
 	.request_fn = BufferManagerShmemRequest,
@@ -119,6 +126,14 @@ BufferManagerShmemRequest(void *arg)
 static void
 BufferManagerShmemInit(void *arg)
 {
+	/*
+	 * Spread the buffer pool over NUMA nodes if requested.  This has to
+	 * happen before the memory is first touched below, since the policy only
+	 * affects pages that haven't been faulted in yet.
+	 */
+	if (numa_interleave_shared_buffers)
+		BufferManagerInterleaveNuma();
+
 	/*
 	 * Initialize all the buffer headers.
 	 */
@@ -151,3 +166,55 @@ BufferManagerShmemAttach(void *arg)
 	WritebackContextInit(&BackendWritebackContext,
 						 &backend_flush_after);
 }
+
+/*
+ * Interleave the buffer descriptors and buffer blocks across NUMA nodes.
+ *
+ * Without this, each page of the buffer pool ends up on the node of whichever
+ * process first touches it.  That tends to concentrate the descriptors on the
+ * postmaster's node, and the blocks on the nodes of whichever backends
+ * happened to read data first, so backends running on other nodes pay for
+ * remote memory accesses on most buffer hits.  Interleaving spreads the pages
+ * evenly, making the average access cost the same from every node.
+ */
+static void
+BufferManagerInterleaveNuma(void)
+{
+	Size		pagesize;
+
+	if (pg_numa_init() == -1)
+	{
+		ereport(WARNING,
+				(errmsg("NUMA is not supported on this platform"),
+				 errdetail("\"%s\" is ignored.",
+						   "numa_interleave_shared_buffers")));
+		return;
+	}
+
+	pagesize = pg_get_shmem_pagesize();
+
+	InterleaveNumaRange("buffer descriptors", BufferDescriptors,
+						NBuffers * sizeof(BufferDescPadded), pagesize);
+	InterleaveNumaRange("buffer blocks", BufferBlocks,
+						NBuffers * (Size) BLCKSZ, pagesize);
+}
+
+/*
+ * Helper for BufferManagerInterleaveNuma().  The memory policy can only be
+ * set for whole memory pages, so pages that the range shares with adjacent
+ * shared memory structures are left alone.
+ */
+static void
+InterleaveNumaRange(const char *name, void *ptr, Size size, Size pagesize)
+{
+	char	   *startptr = (char *) TYPEALIGN(pagesize, ptr);
+	char	   *endptr = (char *) TYPEALIGN_DOWN(pagesize, (char *) ptr + size);
+
+	if (endptr <= startptr)
+		return;
+
+	if (pg_numa_interleave_memory(startptr, endptr - startptr) != 0)
+		ereport(WARNING,
+				(errmsg("could not interleave %s across NUMA nodes: %m",
+						name)));
+}
@@ -2078,6 +2078,46 @@ GetSnapshotDataReuse(Snapshot snapshot)
 	return true;
 }
 
+#ifndef USE_NO_SIMD
+/*
+ * Number of entries of ProcGlobal->xids that GetSnapshotData() checks at once
+ * for being all InvalidTransactionId.
+ */
+#define SNAPSHOT_XID_CHUNK	(4 * sizeof(Vector8) / sizeof(TransactionId))
+
+/*
+ * XidChunkIsInvalid -- helper for GetSnapshotData()
+ *
+ * Returns true if none of the SNAPSHOT_XID_CHUNK xids starting at 'xids' is
+ * assigned.  With many connections, most entries of the dense xids array
+ * typically belong to backends without an xid, and this lets the snapshot
+ * loop skip over them in bulk.
+ */
+static inline bool
+XidChunkIsInvalid(const TransactionId *xids)
+{
+	const uint8 *base = (const uint8 *) xids;
+	Vector8		v1,
+				v2,
+				v3,
+				v4;
+	Vector8		v;
+
+	StaticAssertDecl(InvalidTransactionId == 0,
+					 "InvalidTransactionId must be zero");
+
+	vector8_load(&v1, base);
+	vector8_load(&v2, base + sizeof(Vector8));
+	vector8_load(&v3, base + 2 * sizeof(Vector8));
+	vector8_load(&v4, base + 3 * sizeof(Vector8));
+
+	v = vector8_or(vector8_or(v1, v2), vector8_or(v3, v4));
+
+	return vector8_highbit_mask(vector8_eq(v, vector8_broadcast(0))) ==
+		(1U << sizeof(Vector8)) - 1;
+}
+#endif							/* ! USE_NO_SIMD */
+
 /*
  * GetSnapshotData -- returns information about running transactions.
  *
@@ -2211,10 +2251,29 @@ GetSnapshotData(Snapshot snapshot)
 		 */
 		for (int pgxactoff = 0; pgxactoff < numProcs; pgxactoff++)
 		{
-			/* Fetch xid just once - see GetNewTransactionId */
-			TransactionId xid = UINT32_ACCESS_ONCE(other_xids[pgxactoff]);
+			TransactionId xid;
 			uint8		statusFlags;
 
+#ifndef USE_NO_SIMD
+
+			/*
+			 * At the start of each chunk, check whether any backend in it has
+			 * an xid at all, and skip the whole chunk if not.  An xid that is
+			 * being assigned concurrently is necessarily >= xmax, so missing
+			 * it here is no different from the per-entry check below.
+			 */
+			if (pgxactoff % SNAPSHOT_XID_CHUNK == 0 &&
+				pgxactoff + SNAPSHOT_XID_CHUNK <= numProcs &&
+				XidChunkIsInvalid(&other_xids[pgxactoff]))
+			{
+				pgxactoff += SNAPSHOT_XID_CHUNK - 1;
+				continue;
+			}
+#endif
+
+			/* Fetch xid just once - see GetNewTransactionId */
+			xid = UINT32_ACCESS_ONCE(other_xids[pgxactoff]);
+
 			Assert(allProcs[arrayP->pgprocnos[pgxactoff]].pgxactoff == pgxactoff);
 
 			/*
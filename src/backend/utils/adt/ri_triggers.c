@@ -2979,6 +2979,9 @@ ri_FastPathBatchFlush(RI_FastPathEntry *fpentry, Relation fk_rel,
  * apply, and also for single-row batches of single-column FKs where
  * the array overhead is not worth it.
  *
+ * Consecutive rows with an identical key, as are common in bulk loads of
+ * child rows grouped by parent, share the probe of the first such row.
+ *
  * Returns the index of the first violating row in the batch array, or -1 if
  * all rows are valid.
  */
@@ -2992,6 +2995,8 @@ ri_FastPathFlushLoop(RI_FastPathEntry *fpentry, TupleTableSlot *fk_slot,
 	TupleTableSlot *pk_slot = fpentry->pk_slot;
 	Datum		pk_vals[INDEX_MAX_KEYS];
 	char		pk_nulls[INDEX_MAX_KEYS];
+	Datum		prev_vals[INDEX_MAX_KEYS];
+	bool		have_prev = false;
 	ScanKeyData skey[INDEX_MAX_KEYS];
 	bool		found = true;
 
@@ -2999,6 +3004,39 @@ ri_FastPathFlushLoop(RI_FastPathEntry *fpentry, TupleTableSlot *fk_slot,
 	{
 		ExecStoreHeapTuple(fpentry->batch[i], fk_slot, false);
 		ri_ExtractValues(fk_rel, fk_slot, riinfo, false, pk_vals, pk_nulls);
+
+		/*
+		 * If the key is bytewise identical to that of the previous row, the
+		 * PK row it references has already been found and locked within this
+		 * flush, using the same snapshot, so probing again is pointless.  We
+		 * compare the FK values as extracted from the tuples, before any cast
+		 * to the PK types; pass-by-reference ones point into the buffered
+		 * tuples, which stay valid until the flush context is reset.
+		 * Buffered rows never have NULL keys.
+		 */
+		if (have_prev)
+		{
+			bool		same = true;
+
+			for (int k = 0; k < riinfo->nkeys; k++)
+			{
+				CompactAttribute *att = TupleDescCompactAttr(fk_rel->rd_att,
+															 riinfo->fk_attnums[k] - 1);
+
+				if (!datum_image_eq(prev_vals[k], pk_vals[k],
+									att->attbyval, att->attlen))
+				{
+					same = false;
+					break;
+				}
+			}
+			if (same)
+				continue;
+		}
+
+		/* Save the uncast values; build_index_scankeys() casts in place */
+		memcpy(prev_vals, pk_vals, riinfo->nkeys * sizeof(Datum));
+
 		build_index_scankeys(riinfo, idx_rel, pk_vals, pk_nulls, skey);
 
 		found = ri_FastPathProbeOne(pk_rel, idx_rel, scandesc, pk_slot,
@@ -3007,6 +3045,8 @@ ri_FastPathFlushLoop(RI_FastPathEntry *fpentry, TupleTableSlot *fk_slot,
 		/* Report first unmatched row */
 		if (!found)
 			return i;
+
+		have_prev = true;
 	}
 
 	/* All pass. */
@@ -3,6 +3,17 @@
  * catcache.c
  *	  System catalog cache for tuples matching a key.
  *
+ * The caches are private to each backend.  Sharing them between backends
+ * would be attractive for memory use and connection warm-up, but is not
+ * straightforward: an entry reflects the catalog contents as seen by the
+ * backend that loaded it, including catalog changes made by its own
+ * in-progress transaction, and invalidation messages are only applied by
+ * each backend at well-defined points (see inval.c) rather than immediately.
+ * A shared cache would need to track the visibility of every entry and
+ * coordinate invalidation with all readers.  The closest thing we have is
+ * the relation cache init file (see relcache.c), which lets new backends
+ * start with the most important relcache entries already loaded.
+ *
  * Portions Copyright (c) 1996-2026, PostgreSQL Global Development Group
  * Portions Copyright (c) 1994, Regents of the University of California
  *
@@ -433,6 +433,8 @@ extern TransactionId heap_index_delete_tuples(Relation rel,
 extern IndexFetchTableData *heapam_index_fetch_begin(Relation rel, uint32 flags);
 extern void heapam_index_fetch_reset(IndexFetchTableData *scan);
 extern void heapam_index_fetch_end(IndexFetchTableData *scan);
+extern bool heapam_index_fetch_prefetch(IndexFetchTableData *scan,
+										ItemPointer tid);
 extern bool heap_hot_search_buffer(ItemPointer tid, Relation relation,
 								   Buffer buffer, Snapshot snapshot, HeapTuple heapTuple,
 								   bool *all_dead, bool first_call);
@@ -1072,6 +1072,17 @@ typedef struct BTScanOpaqueData
 	int			numKilled;		/* number of currently stored items */
 	bool		dropPin;		/* drop leaf pin before btgettuple returns? */
 
+	/*
+	 * State for prefetching heap tuples referenced by currPos.items[] during
+	 * plain index scans (see _bt_prefetch_heap).  The maximum look-ahead
+	 * distance is scan->xs_prefetch_maximum.  prefetchDir is set to
+	 * NoMovementScanDirection whenever currPos is reloaded or repositioned,
+	 * which makes prefetchItem invalid.
+	 */
+	int			prefetchDistance;	/* current look-ahead distance */
+	ScanDirection prefetchDir;	/* direction prefetchItem advances in */
+	int			prefetchItem;	/* last currPos.items[] entry considered */
+
 	/*
 	 * If we are doing an index-only scan, these are the tuple storage
 	 * workspaces for the currPos and markPos respectively.  Each is of size
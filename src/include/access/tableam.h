@@ -495,6 +495,21 @@ typedef struct TableAmRoutine
 									  TupleTableSlot *slot,
 									  bool *call_again, bool *all_dead);
 
+	/*
+	 * Hint that the tuple at `tid` is likely to be fetched soon by
+	 * index_fetch_tuple, so that the AM can start reading it in
+	 * asynchronously.  Index AMs call this for upcoming TIDs during plain
+	 * index scans when the caller enabled prefetching (see
+	 * IndexScanDescData.xs_prefetch_maximum).  Returns true if I/O was
+	 * started, false if the data was already cached (or the hint was
+	 * otherwise not useful), which index AMs use to stop prefetching for
+	 * cached workloads.
+	 *
+	 * Optional callback.
+	 */
+	bool		(*index_fetch_prefetch) (struct IndexFetchTableData *scan,
+										 ItemPointer tid);
+
 
 	/* ------------------------------------------------------------------------
 	 * Callbacks for non-modifying operations on individual tuples
@@ -1277,6 +1292,19 @@ table_index_fetch_end(struct IndexFetchTableData *scan)
 	scan->rel->rd_tableam->index_fetch_end(scan);
 }
 
+/*
+ * Hint that the tuple at `tid` will probably be fetched soon as part of an
+ * index scan.  Returns true if the AM started I/O for it.  This is a no-op
+ * returning false for AMs that don't implement it.
+ */
+static inline bool
+table_index_fetch_prefetch(struct IndexFetchTableData *scan, ItemPointer tid)
+{
+	if (scan->rel->rd_tableam->index_fetch_prefetch)
+		return scan->rel->rd_tableam->index_fetch_prefetch(scan, tid);
+	return false;
+}
+
 /*
  * Fetches, as part of an index scan, tuple at `tid` into `slot`, after doing
  * a visibility test according to `snapshot`. If a tuple was found and passed
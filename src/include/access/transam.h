@@ -61,6 +61,15 @@
  * A 64 bit value that contains an epoch and a TransactionId.  This is
  * wrapped in a struct to prevent implicit conversion to/from TransactionId.
  * Not all values represent valid normal XIDs.
+ *
+ * The XID counter itself is 64 bits wide, but only the low 32 bits are
+ * stored on disk in heap tuple headers and in most catalogs, and pg_xact
+ * is indexed by the 32-bit XID.  That is why tables still have to be
+ * frozen before their oldest XIDs fall more than 2^31 transactions behind;
+ * see "Preventing Transaction ID Wraparound Failures" in the documentation.
+ * Storing the epoch on disk, e.g. as a per-page base in the heap page special
+ * space, would remove that requirement but changes the on-disk format of
+ * every heap page.
  */
 typedef struct FullTransactionId
 {
@@ -14,6 +14,7 @@
 #ifndef HASHJOIN_H
 #define HASHJOIN_H
 
+#include "lib/bloomfilter.h"
 #include "nodes/execnodes.h"
 #include "port/atomics.h"
 #include "storage/barrier.h"
@@ -359,6 +360,17 @@ typedef struct HashJoinTableData
 	BufFile   **innerBatchFile; /* buffered virtual temp file per batch */
 	BufFile   **outerBatchFile; /* buffered virtual temp file per batch */
 
+	/*
+	 * Bloom filter over the hash values of all inner tuples, or NULL.  It is
+	 * only built for non-parallel multi-batch joins that need not emit
+	 * unmatched outer tuples, and lets us discard outer tuples that cannot
+	 * have a match instead of writing them to an outer batch file.  Its
+	 * memory is included in spaceUsed while it exists.
+	 */
+	bloom_filter *bloomFilter;
+	Size		bloomSpace;		/* memory charged for the Bloom filter */
+	int64		bloomRejected;	/* # outer tuples rejected by the filter */
+
 	Size		spaceUsed;		/* memory space currently used by tuples */
 	Size		spaceAllowed;	/* upper limit for space used */
 	Size		spacePeak;		/* peak space used */
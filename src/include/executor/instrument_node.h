@@ -227,6 +227,8 @@ typedef struct HashInstrumentation
 	int			nbatch;			/* number of batches at end of execution */
 	int			nbatch_original;	/* planned number of batches */
 	Size		space_peak;		/* peak memory usage in bytes */
+	Size		bloom_space;	/* Bloom filter memory in bytes, or 0 */
+	int64		bloom_rejected; /* outer tuples rejected by Bloom filter */
 } HashInstrumentation;
 
 /*
@@ -68,6 +68,9 @@ typedef struct LLVMJitContext
 
 	/* list of handles for code emitted via Orc */
 	List	   *handles;
+
+	/* deform functions generated in the current module, see llvmjit_deform.c */
+	List	   *deform_cache;
 } LLVMJitContext;
 
 /* type and struct definitions */
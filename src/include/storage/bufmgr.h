@@ -161,6 +161,9 @@ typedef struct WritebackContext WritebackContext;
 /* in globals.c ... this duplicates miscadmin.h */
 extern PGDLLIMPORT int NBuffers;
 
+/* in buf_init.c */
+extern PGDLLIMPORT bool numa_interleave_shared_buffers;
+
 /* in bufmgr.c */
 extern PGDLLIMPORT bool zero_damaged_pages;
 extern PGDLLIMPORT int bgwriter_lru_maxpages;
@@ -82,8 +82,18 @@ extern PGDLLIMPORT LWLockPadded *MainLWLockArray;
 /* Number of partitions of the shared buffer mapping hashtable */
 #define NUM_BUFFER_PARTITIONS  128
 
-/* Number of partitions the shared lock tables are divided into */
-#define LOG2_NUM_LOCK_PARTITIONS  4
+/*
+ * Number of partitions the shared lock tables are divided into.  Queries on
+ * tables with many partitions or indexes can exhaust a backend's fast-path
+ * lock slots, after which every relation lock goes through the shared lock
+ * table, so we want enough partitions to keep the LWLocks protecting them
+ * from becoming a bottleneck on large machines.  More partitions are not
+ * free, though: each PGPROC has a list header per partition (myProcLocks),
+ * and operations such as deadlock checking and GetLockStatusData() acquire
+ * all of these locks at once, so this must stay well below
+ * MAX_SIMUL_LWLOCKS.
+ */
+#define LOG2_NUM_LOCK_PARTITIONS  6
 #define NUM_LOCK_PARTITIONS  (1 << LOG2_NUM_LOCK_PARTITIONS)
 
 /* Number of partitions the shared predicate lock tables are divided into */
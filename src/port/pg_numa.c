@@ -118,6 +118,21 @@ pg_numa_get_max_node(void)
 	return numa_max_node();
 }
 
+/*
+ * Set the memory policy of the given range so that its pages are interleaved
+ * across all NUMA nodes.  This only affects pages that have not been faulted
+ * in yet.  The range must be aligned to the memory page size.
+ *
+ * We call mbind(2) directly rather than numa_interleave_memory(), because the
+ * latter reports errors by printing to stderr instead of returning them.
+ */
+int
+pg_numa_interleave_memory(void *ptr, Size size)
+{
+	return mbind(ptr, size, MPOL_INTERLEAVE, numa_all_nodes_ptr->maskp,
+				 numa_all_nodes_ptr->size + 1, 0);
+}
+
 #else
 
 /* Empty wrappers */
@@ -140,4 +155,11 @@ pg_numa_get_max_node(void)
 	return 0;
 }
 
+int
+pg_numa_interleave_memory(void *ptr, Size size)
+{
+	errno = ENOSYS;
+	return -1;
+}
+
 #endif
@@ -438,3 +438,38 @@ CREATE TABLE btree_part (id int4) PARTITION BY RANGE (id);
 CREATE INDEX btree_part_idx ON btree_part(id);
 ALTER INDEX btree_part_idx ALTER COLUMN id SET (n_distinct=100);
 DROP TABLE btree_part;
+
+-- Test plain index scans that prefetch heap blocks.  The rows are inserted
+-- in random order so that neighboring index entries point to different heap
+-- blocks.
+CREATE TABLE btree_prefetch (a int, b text);
+INSERT INTO btree_prefetch
+  SELECT i, repeat('x', 500) FROM generate_series(1, 1000) i ORDER BY random();
+CREATE INDEX btree_prefetch_a_idx ON btree_prefetch (a);
+ANALYZE btree_prefetch;
+SET enable_seqscan = off;
+SET enable_bitmapscan = off;
+SET effective_io_concurrency = 16;
+EXPLAIN (COSTS OFF)
+SELECT count(*), sum(a), sum(length(b)) FROM btree_prefetch
+  WHERE a BETWEEN 100 AND 900;
+SELECT count(*), sum(a), sum(length(b)) FROM btree_prefetch
+  WHERE a BETWEEN 100 AND 900;
+EXPLAIN (COSTS OFF)
+SELECT a, length(b) FROM btree_prefetch
+  WHERE a > 10 ORDER BY a DESC LIMIT 3;
+SELECT a, length(b) FROM btree_prefetch
+  WHERE a > 10 ORDER BY a DESC LIMIT 3;
+-- Change scan direction in the middle of a leaf page
+BEGIN;
+DECLARE c SCROLL CURSOR FOR
+  SELECT a, length(b) FROM btree_prefetch
+  WHERE a BETWEEN 100 AND 900 ORDER BY a;
+FETCH 3 FROM c;
+FETCH BACKWARD 2 FROM c;
+FETCH 3 FROM c;
+COMMIT;
+RESET enable_seqscan;
+RESET enable_bitmapscan;
+RESET effective_io_concurrency;
+DROP TABLE btree_prefetch;
@@ -544,3 +544,25 @@ ALTER TABLE pp_dropcol ATTACH PARTITION pp_dropcol_1 FOR VALUES FROM (1) TO (10)
 INSERT INTO pp_dropcol VALUES (1, 11), (2, 12);
 COPY pp_dropcol TO stdout(header);
 DROP TABLE pp_dropcol;
+
+-- Test COPY FROM with fields long enough to exercise the vectorized
+-- field-splitting code, with special characters at various offsets.
+create temp table copytest_simd (id int, t text);
+insert into copytest_simd
+  select g, repeat('abcdefghij', g % 5) || E'\t\\"' || repeat('x', g) ||
+            E'\n,''' || repeat('0123456789', 3)
+  from generate_series(1, 40) g;
+create temp table copytest_simd2 (like copytest_simd);
+\set filename :abs_builddir '/results/copytest_simd.data'
+copy copytest_simd to :'filename';
+copy copytest_simd2 from :'filename';
+select * from copytest_simd except select * from copytest_simd2;
+truncate copytest_simd2;
+copy copytest_simd to :'filename' csv;
+copy copytest_simd2 from :'filename' csv;
+select * from copytest_simd except select * from copytest_simd2;
+truncate copytest_simd2;
+copy copytest_simd to :'filename' csv quote '''' escape E'\\';
+copy copytest_simd2 from :'filename' csv quote '''' escape E'\\';
+select * from copytest_simd except select * from copytest_simd2;
+drop table copytest_simd, copytest_simd2;
@@ -2680,3 +2680,25 @@ INSERT INTO fp_pk_dup VALUES (1);
 CREATE TABLE fp_fk_dup (a int REFERENCES fp_pk_dup);
 INSERT INTO fp_fk_dup SELECT 1 FROM generate_series(1, 100);
 DROP TABLE fp_fk_dup, fp_pk_dup;
+
+-- Duplicate composite FK values: consecutive rows with an identical key
+-- share one probe, but a different key after them must still be checked
+CREATE TABLE fp_pk_dup2 (a int, b text, PRIMARY KEY (a, b));
+INSERT INTO fp_pk_dup2 VALUES (1, 'one');
+CREATE TABLE fp_fk_dup2 (a int, b text,
+    FOREIGN KEY (a, b) REFERENCES fp_pk_dup2);
+INSERT INTO fp_fk_dup2 SELECT 1, 'one' FROM generate_series(1, 100);
+INSERT INTO fp_fk_dup2
+  SELECT 1, CASE WHEN i < 50 THEN 'one' ELSE 'two' END
+  FROM generate_series(1, 60) i;  -- should fail
+DROP TABLE fp_fk_dup2, fp_pk_dup2;
+-- Same with a cross-type key, whose FK values are cast before probing
+CREATE TABLE fp_pk_dup3 (a numeric, b text, PRIMARY KEY (a, b));
+INSERT INTO fp_pk_dup3 VALUES (1, 'one');
+CREATE TABLE fp_fk_dup3 (a int, b text,
+    FOREIGN KEY (a, b) REFERENCES fp_pk_dup3);
+INSERT INTO fp_fk_dup3 SELECT 1, 'one' FROM generate_series(1, 100);
+INSERT INTO fp_fk_dup3
+  SELECT CASE WHEN i < 50 THEN 1 ELSE 2 END, 'one'
+  FROM generate_series(1, 60) i;  -- should fail
+DROP TABLE fp_fk_dup3, fp_pk_dup3;
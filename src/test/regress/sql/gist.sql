@@ -180,6 +180,34 @@ reset enable_indexonlyscan;
 
 drop table gist_tbl;
 
+-- Test a parallel sorted build, and check that queries using the index
+-- return the same results as with a serially built one.
+create table gist_parallel_tbl (id int, p point);
+insert into gist_parallel_tbl
+  select i, point(i % 100, i / 100) from generate_series(0, 9999) i;
+begin;
+set local min_parallel_table_scan_size = 0;
+set local max_parallel_maintenance_workers = 4;
+create index gist_parallel_tbl_p_idx on gist_parallel_tbl using gist (p);
+commit;
+set enable_seqscan = off;
+set enable_bitmapscan = off;
+explain (costs off)
+select count(*), sum(id) from gist_parallel_tbl where p <@ box '(10,10),(20,20)';
+select count(*), sum(id) from gist_parallel_tbl where p <@ box '(10,10),(20,20)';
+explain (costs off)
+select id, p from gist_parallel_tbl order by p <-> point(50.2, 50.4) limit 3;
+select id, p from gist_parallel_tbl order by p <-> point(50.2, 50.4) limit 3;
+drop index gist_parallel_tbl_p_idx;
+set max_parallel_maintenance_workers = 0;
+create index gist_parallel_tbl_p_idx on gist_parallel_tbl using gist (p);
+select count(*), sum(id) from gist_parallel_tbl where p <@ box '(10,10),(20,20)';
+select id, p from gist_parallel_tbl order by p <-> point(50.2, 50.4) limit 3;
+reset max_parallel_maintenance_workers;
+reset enable_seqscan;
+reset enable_bitmapscan;
+drop table gist_parallel_tbl;
+
 -- test an unlogged table, mostly to get coverage of gistbuildempty
 create unlogged table gist_tbl (b box);
 create index gist_tbl_box_index on gist_tbl using gist (b);
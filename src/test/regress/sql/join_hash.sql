@@ -53,6 +53,28 @@ begin
 end;
 $$;
 
+-- Extract Bloom filter memory usage and the number of outer rows it
+-- rejected from an explain analyze plan.  Both are null if no filter
+-- was used.
+create or replace function hash_join_bloom(query text)
+returns table (memory_kb bigint, rejected bigint) language plpgsql
+as
+$$
+declare
+  whole_plan json;
+  hash_node json;
+begin
+  for whole_plan in
+    execute 'explain (analyze, format ''json'') ' || query
+  loop
+    hash_node := find_hash(json_extract_path(whole_plan, '0', 'Plan'));
+    memory_kb := hash_node->>'Bloom Filter Memory Usage';
+    rejected := hash_node->>'Bloom Filter Rejected Rows';
+    return next;
+  end loop;
+end;
+$$;
+
 -- Make a simple relation with well distributed keys and correctly
 -- estimated size.
 create table simple as
@@ -156,6 +178,42 @@ select original > 1 as initially_multibatch, final > original as increased_batch
 $$
   select count(*) from simple r join simple s using (id);
 $$);
+-- no room for a Bloom filter in this little memory
+select memory_kb is null as no_bloom_filter
+  from hash_join_bloom(
+$$
+  select count(*) from simple r join simple s using (id);
+$$);
+rollback to settings;
+
+-- Bloom filter: outer tuples without a partner are discarded instead of
+-- being written to a batch file, but only when they need not be
+-- null-extended.  The filter takes at least 1MB, which must fit in a
+-- quarter of the hash table's memory.
+savepoint settings;
+set local max_parallel_workers_per_gather = 0;
+set local work_mem = '6MB';
+set local hash_mem_multiplier = 1.0;
+set local enable_mergejoin = off;
+create table bloom_probe as
+  select generate_series(1, 80000) as id, repeat('x', 100) as t;
+analyze bloom_probe;
+select count(*), sum(length(r.t) + length(s.t))
+  from bloom_probe r join bloom_probe s on r.id = s.id + 40000;
+select memory_kb >= 1024 as bloom_filter, rejected > 0 as rejected_rows
+  from hash_join_bloom(
+$$
+  select count(*), sum(length(r.t) + length(s.t))
+    from bloom_probe r join bloom_probe s on r.id = s.id + 40000;
+$$);
+select count(*), sum(length(r.t) + coalesce(length(s.t), 0))
+  from bloom_probe r left join bloom_probe s on r.id = s.id + 40000;
+select memory_kb is null as no_bloom_filter
+  from hash_join_bloom(
+$$
+  select count(*), sum(length(r.t) + coalesce(length(s.t), 0))
+    from bloom_probe r left join bloom_probe s on r.id = s.id + 40000;
+$$);
 rollback to settings;
 
 -- parallel with parallel-oblivious hash join